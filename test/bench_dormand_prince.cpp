@@ -0,0 +1,78 @@
+# include <iostream>
+# include <iomanip>
+# include <string>
+# include <cmath>
+# include "../rhsOdeProblem.H"
+# include "../RungeKutta/RungeKutta4th/RungeKutta4Solver.H"
+# include "../RungeKutta/DormandPrince/DormandPrinceSolver.H"
+
+using namespace std;
+using namespace mg::numeric::ode ;
+
+/*-----------------------------------------------------------------------------
+ *
+ *    Work-precision : fixed step RK4 (dt sweep) versus adaptive
+ *    Dormand-Prince 5(4) (rtol sweep), max error against the exact
+ *    solution versus the number of rhs evaluations
+ *
+ -----------------------------------------------------------------------------*/
+
+
+template <typename Fun, typename Exact>
+void runProblem(const string name, Fun numFun, Exact exacFun,
+                const double t0, const double tf, const double u0)
+{
+   std::size_t nEval = 0 ;
+   auto counted = [&nEval,numFun](double t, double u) { ++nEval ; return numFun(t,u) ; } ;
+
+   double maxErr = 0 ;
+   auto error = [&maxErr,exacFun](double t, double u) { maxErr = max(maxErr, fabs(u - exacFun(t,u))); } ;
+
+   cout << name << endl ;
+   cout << setw(8) << "scheme" << setw(12) << "dt / rtol" << setw(10) << "steps"
+        << setw(10) << "rejected" << setw(12) << "rhs evals" << setw(14) << "max error" << endl ;
+
+   for(std::size_t Ns = 16 ; Ns <= 4096 ; Ns *= 4)
+   {
+      auto p = makeOdeProblem(counted, t0, tf, (tf-t0)/Ns, u0) ;
+      RungeKutta4Solver<double, decltype(counted)> rk4(p) ;
+
+      nEval = 0 ; maxErr = 0 ;
+      rk4.stream(error) ;
+
+      cout << setw(8) << "RK4" << setw(12) << (tf-t0)/Ns << setw(10) << Ns
+           << setw(10) << 0 << setw(12) << nEval << setw(14) << maxErr << endl ;
+   }
+
+   for(double rtol = 1e-3 ; rtol >= 1e-11 ; rtol *= 1e-2)
+   {
+      auto p = makeOdeProblem(counted, t0, tf, (tf-t0)/100, u0) ;
+      DormandPrinceSolver<double, decltype(counted)> dp(p) ;
+      dp.setTolerance(rtol, rtol*1e-3) ;
+
+      nEval = 0 ; maxErr = 0 ;
+      dp.stream(error) ;
+
+      cout << setw(8) << "DP5(4)" << setw(12) << rtol << setw(10) << dp.acceptedSteps()
+           << setw(10) << dp.rejectedSteps() << setw(12) << dp.rhsEvaluations() << setw(14) << maxErr << endl ;
+   }
+   cout << endl ;
+}
+
+
+int main(){
+
+   cout << setprecision(3) ;
+
+   runProblem("problem1",
+              [](double t, double u) { return -10*(t-1)*u; },
+              [](double t, double  ) { return exp(-5*pow((t-1),2) ); },
+              0.0, 2.0, exp(-5.0));
+
+   runProblem("problem2",
+              [](double t, double u) { return -20*u+20*sin(t)+cos(t) ; },
+              [](double t, double  ) { return exp(-20*t)+sin(t) ; },
+              0.0, 2.5, 1.0);
+
+  return 0;
+}
@@ -0,0 +1,120 @@
+# include <iostream>
+# include <iomanip>
+# include <string>
+# include <vector>
+# include <chrono>
+# include <cmath>
+# include "../rhsOdeProblem.H"
+# include "../Euler/ForwardEulerSolver.H"
+# include "../RungeKutta/RungeKutta4th/RungeKutta4Solver.H"
+# include "../MultiStep/AdamsMethods/AdamsBashforth/AdamsBashforth4thSolver.H"
+# include "../Ensemble/EnsembleForwardEulerSolver.H"
+# include "../Ensemble/EnsembleRungeKutta4Solver.H"
+# include "../Ensemble/EnsembleAdamsBashforthSolver.H"
+
+using namespace std;
+using namespace mg::numeric::ode ;
+
+/*-----------------------------------------------------------------------------
+ *
+ *    Benchmark : parameter sweep of problem 1 , dy/dt = -k (t-1) y ,
+ *    N initial values / rates integrated
+ *      - one rhsOdeProblem + solver object per trajectory (scalar)
+ *      - in lockstep by the ensemble solvers (one SIMD lane per trajectory)
+ *
+ *    throughput in trajectories*steps per second ; |du| is the largest
+ *    difference of the final values between the two
+ *
+ *    g++ -std=c++17 -O3 -march=native           bench_ensemble.cpp
+ *    g++ -std=c++17 -O3 -DMG_ODE_SIMD_BYTES=0 -fno-tree-vectorize ...  (scalar)
+ *
+ *    MG_ODE_SIMD_BYTES only pads and aligns the lanes , the scalar build
+ *    is -fno-tree-vectorize
+ *
+ -----------------------------------------------------------------------------*/
+
+
+template <typename Run>
+double bestOf(Run&& run)
+{
+   double best = 1e300 ;
+   for(int r=0 ; r < 3 ; r++)
+   {
+      auto start = chrono::steady_clock::now();
+      run();
+      auto stop  = chrono::steady_clock::now();
+      best = min(best, chrono::duration<double>(stop-start).count());
+   }
+   return best ;
+}
+
+
+template <template <typename, typename> class Solver, typename Ens>
+void runScheme(const string name, Ens& ens,
+               const vector<double>& u0s, const vector<double>& ks,
+               const double t0, const double tf, const double dt)
+{
+   const std::size_t N  = u0s.size() ;
+   const double      Ns = (tf-t0)/dt ;
+
+   vector<double> uScalar(N) ;
+
+   const double tScalar = bestOf([&]{
+      for(std::size_t i=0 ; i < N ; i++)
+      {
+         const double k = ks[i] ;
+         auto fun = [k](double t, double u) { return -k*(t-1)*u; } ;
+         auto p   = makeOdeProblem(fun, t0, tf, dt, u0s[i]) ;
+         Solver<double, decltype(fun)> solver(p) ;
+         solver.stream([&](double, double u){ uScalar[i] = u ; });
+      }
+   });
+
+   const double tEnsemble = bestOf([&]{ ens.solve(); });
+
+   double du = 0 ;
+   for(std::size_t i=0 ; i < N ; i++) du = max(du, fabs(ens.u(i) - uScalar[i])) ;
+
+   cout << setw(8) << name
+        << setw(16) << N*Ns/tScalar << setw(16) << N*Ns/tEnsemble
+        << setw(10) << tScalar/tEnsemble << setw(12) << du << endl ;
+}
+
+
+int main(){
+
+   const double t0 = 0.0 , tf = 2.0 , dt = 1e-3 ;
+   const std::size_t N = 4096 ;
+
+   vector<double> u0s(N) , ks(N) ;
+   for(std::size_t i=0 ; i < N ; i++)
+   {
+      u0s[i] = exp(-5.0) * (1.0 + 0.001*i) ;
+      ks[i]  = 5.0 + 10.0*i/N ;
+   }
+
+   auto p = makeEnsembleProblem([](double t, double u, double k) { return -k*(t-1)*u; },
+                                t0, tf, dt, u0s, ks);
+
+   EnsembleForwardEulerSolver    ens1(p) ;
+   EnsembleRungeKutta4Solver     ens2(p) ;
+   EnsembleAdamsBashforthSolver<4, double, decltype(p)::function_type> ens3(p) ;
+
+   cout << "lanes per register : " << ens1.lanes << " , trajectories : " << N << endl ;
+
+   cout << setprecision(4) ;
+   cout << setw(8) << "scheme" << setw(16) << "scalar t*s/s" << setw(16) << "ensemble t*s/s"
+        << setw(10) << "speedup" << setw(12) << "|du|" << endl ;
+
+   runScheme<ForwardEulerSolver>     ("Euler", ens1, u0s, ks, t0, tf, dt);
+   runScheme<RungeKutta4Solver>      ("RK4"  , ens2, u0s, ks, t0, tf, dt);
+   runScheme<AdamsBashforth4thSolver>("AB4"  , ens3, u0s, ks, t0, tf, dt);
+
+   // accuracy of the ensemble against the exact solution y0 exp(-k/2 ((t-1)^2 - 1))
+   double err = 0 ;
+   for(std::size_t i=0 ; i < N ; i++)
+      err = max(err, fabs(ens2.u(i) - u0s[i]*exp(-ks[i]/2*((tf-1)*(tf-1) - 1)))) ;
+   cout << "RK4 ensemble max error : " << err << endl ;
+
+  return 0;
+}
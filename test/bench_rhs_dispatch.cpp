@@ -0,0 +1,96 @@
+# include <iostream>
+# include <iomanip>
+# include <string>
+# include <chrono>
+# include <cmath>
+# include "../rhsOdeProblem.H"
+# include "../Euler/ForwardEulerSolver.H"
+# include "../RungeKutta/RungeKutta4th/RungeKutta4Solver.H"
+# include "../MultiStep/AdamsMethods/AdamsBashforth/AdamsBashforth4thSolver.H"
+
+using namespace std;
+using namespace mg::numeric::ode ;
+
+/*-----------------------------------------------------------------------------
+ *
+ *    Benchmark : rhs called through std::function (rhsOdeProblem<double> ,
+ *    type-erased fallback) versus the closure stored by value
+ *    (makeOdeProblem) , through the solvers themselves
+ *
+ *    ForwardEuler , RungeKutta4 and AdamsBashforth4 solvers built on each
+ *    problem and run by stream() with an observer keeping the last value ,
+ *    the same observer for both , so the difference is the rhs dispatch
+ *
+ -----------------------------------------------------------------------------*/
+
+
+auto numFun1 = [](double t, double u) { return -10*(t-1)*u; } ;
+auto numFun2 = [](double t, double u) { return -20*u+20*sin(t)+cos(t) ; } ;
+auto numFun3 = [](double t, double u) { return t*u ; } ;
+auto numFun4 = [](double t, double u) { return -2.0*t*u*u; } ;
+auto numFun5 = [](double t, double u) { return (2*t*u*u + 4)/(2*(3-t*t*u)) ; } ;
+
+
+// best of nRep wall times of stream() , in ns per step ; result is u(tf)
+template <typename Solver>
+double timeSolver(Solver&& solver, const std::size_t Ns, double& result)
+{
+   solver.setProgress(nullptr) ;
+
+   const int nRep = 5 ;
+   double best = 1e300 ;
+   for(int r=0 ; r < nRep ; r++)
+   {
+      auto start = chrono::steady_clock::now();
+      solver.stream([&result](double, double u){ result = u ; });
+      auto stop  = chrono::steady_clock::now();
+      best = min(best, chrono::duration<double,nano>(stop-start).count() / Ns );
+   }
+   return best ;
+}
+
+
+template <template <typename, typename> class Solver, typename P, typename Q>
+void runScheme(const string name, const string scheme, const P& erased, const Q& inlined, const std::size_t Ns)
+{
+   double ue , ui ;
+
+   const double tErased  = timeSolver(Solver<double, typename P::function_type>(erased) , Ns, ue);
+   const double tInlined = timeSolver(Solver<double, typename Q::function_type>(inlined), Ns, ui);
+
+   cout << setw(10) << name << setw(17) << scheme
+        << setw(14) << tErased << setw(14) << tInlined
+        << setw(10) << tErased/tInlined << setw(14) << fabs(ue-ui) << endl ;
+}
+
+
+template <typename F>
+void runProblem(const string name, F numFun, const double t0, const double tf, const double u0)
+{
+   const std::size_t Ns = 2000000 ;
+   const double dt = (tf-t0)/Ns ;
+
+   rhsOdeProblem<double> erased(numFun, t0, tf, dt, u0);   // std::function
+   auto inlined = makeOdeProblem(numFun, t0, tf, dt, u0);  // closure by value
+
+   runScheme<ForwardEulerSolver>     (name, "ForwardEuler"   , erased, inlined, Ns);
+   runScheme<RungeKutta4Solver>      (name, "RungeKutta4"    , erased, inlined, Ns);
+   runScheme<AdamsBashforth4thSolver>(name, "AdamsBashforth4", erased, inlined, Ns);
+}
+
+
+int main(){
+
+   cout << setprecision(4) ;
+   cout << setw(10) << "problem" << setw(17) << "solver"
+        << setw(14) << "function ns" << setw(14) << "inline ns"
+        << setw(10) << "speedup" << setw(14) << "|du|" << endl ;
+
+   runProblem("problem1", numFun1,  0.0,  2.0, exp(-5.0));
+   runProblem("problem2", numFun2,  0.0,  2.5, 1.0);
+   runProblem("problem3", numFun3, -2.0,  2.0, exp(2.0));
+   runProblem("problem4", numFun4, -5.0,  5.0, 1.0/26.0);
+   runProblem("problem5", numFun5, -1.0, -0.1, 8.0);
+
+  return 0;
+}
@@ -0,0 +1,224 @@
+# include <iostream>
+# include <fstream>
+# include <iomanip>
+# include <string>
+# include <vector>
+# include <chrono>
+# include <cmath>
+# include <limits>
+# include "../rhsOdeProblem.H"
+# include "../SolverFactory.H"
+
+using namespace std;
+using namespace mg::numeric::ode ;
+
+/*-----------------------------------------------------------------------------
+ *
+ *    Work-precision benchmark : every fixed step solver of SolverFactory on
+ *    problems 1-5 (the main_problem drivers) over a sweep of dt
+ *
+ *       bench_work_precision [csv|json] [file]     (default csv on stdout)
+ *
+ *    one record per (problem , solver , dt) :
+ *
+ *       steps , wall time (best of the repetitions) , ns/step ,
+ *       rhs evaluations (Jacobian differences included) ,
+ *       max and L2 (sqrt sum dt e^2) error against analiticalFunction
+ *
+ *    the timed run only stores (t,u) , the errors are computed afterwards ;
+ *    a solver that throws (Newton failure ...) is recorded with its status
+ *    and no timing ; non finite errors are written as inf/nan (csv) or null
+ *    (json). Dormand-Prince is adaptive (dt is only its first step) and is
+ *    left to bench_dormand_prince
+ *
+ -----------------------------------------------------------------------------*/
+
+
+struct Record
+{
+   string      problem ;
+   string      solver ;
+   double      dt ;
+   size_t      steps ;
+   size_t      reps ;
+   double      ms ;
+   double      nsPerStep ;
+   size_t      rhsEvals ;
+   double      maxErr ;
+   double      l2Err ;
+   string      status ;
+};
+
+
+const vector<SolverKind> kinds = { SolverKind::ForwardEuler   , SolverKind::BackwardEuler  ,
+                                   SolverKind::Heun           , SolverKind::ModifiedEuler  ,
+                                   SolverKind::RungeKutta4    , SolverKind::CrankNicholson ,
+                                   SolverKind::LeapFrog       ,
+                                   SolverKind::AdamsBashforth2, SolverKind::AdamsBashforth3,
+                                   SolverKind::AdamsBashforth4, SolverKind::AdamsBashforth5,
+                                   SolverKind::AdamsMoulton2  , SolverKind::AdamsMoulton3  ,
+                                   SolverKind::AdamsMoulton4  , SolverKind::AdamsMoulton5  } ;
+
+// Ns = 16 ... 16384 steps on [t0,tf]
+const vector<size_t> sweep = { 16, 64, 256, 1024, 4096, 16384 } ;
+
+const double minTime = 20 ;   // ms of repetitions per record (at least one run)
+const size_t maxReps = 200 ;
+
+
+template <typename Fun, typename Exact>
+void runProblem(vector<Record>& records, const string name, Fun numFun, Exact exacFun,
+                const double t0, const double tf, const double u0)
+{
+   size_t nEval = 0 ;
+   auto counted = [&nEval,numFun](double t, double u) { ++nEval ; return numFun(t,u) ; } ;
+
+   cerr << name << " ..." << endl ;
+
+   for(const auto kind : kinds)
+   {
+      for(const auto Ns : sweep)
+      {
+         auto p = makeOdeProblem(counted, t0, tf, (tf-t0)/Ns, u0) ;
+         p.setExact(exacFun) ;
+
+         auto solver = makeSolver(kind, p) ;
+         solver->setProgress(nullptr) ;
+
+         Record r { name, toString(kind), p.dt(), 0, 0, 0, 0, 0, 0, 0, "ok" } ;
+
+         vector<double> ts , us ;
+         ts.reserve(Ns+2) ;
+         us.reserve(Ns+2) ;
+         auto store = [&](double t, double u) { ts.push_back(t) ; us.push_back(u) ; } ;
+
+         try
+         {
+            double total = 0 , best = numeric_limits<double>::max() ;
+            while( r.reps == 0 || (total < minTime && r.reps < maxReps) )
+            {
+               ts.clear() ; us.clear() ; nEval = 0 ;
+
+               const auto start = chrono::steady_clock::now() ;
+               solver->stream(store) ;
+               const double ms = chrono::duration<double,milli>(chrono::steady_clock::now() - start).count() ;
+
+               total += ms ;
+               best   = min(best, ms) ;
+               ++r.reps ;
+            }
+
+            r.steps     = ts.size() - 1 ;
+            r.ms        = best ;
+            r.nsPerStep = 1e6*best/r.steps ;
+            r.rhsEvals  = nEval ;
+
+            double sum = 0 ;
+            for(size_t n=1 ; n < ts.size() ; n++)
+            {
+               const double e = fabs(us[n] - p.analiticalFunction(ts[n], us[n])) ;
+               r.maxErr = isnan(e) ? e : max(r.maxErr, e) ;   // nan sticks
+               sum     += (ts[n]-ts[n-1])*e*e ;
+            }
+            r.l2Err = sqrt(sum) ;
+         }
+         catch(const exception& e)
+         {
+            r.status = string("failed: ") + e.what() ;
+         }
+
+         records.push_back(r) ;
+      }
+   }
+}
+
+
+
+void writeCsv(ostream& out, const vector<Record>& records)
+{
+   out << "problem,solver,dt,steps,reps,wall_ms,ns_per_step,rhs_evals,max_error,l2_error,status\n" ;
+   out << setprecision(6) ;
+
+   for(const auto& r : records)
+      out << r.problem << ',' << r.solver << ',' << r.dt << ',' << r.steps << ',' << r.reps << ','
+          << r.ms << ',' << r.nsPerStep << ',' << r.rhsEvals << ',' << r.maxErr << ',' << r.l2Err << ','
+          << '"' << r.status << '"' << '\n' ;
+}
+
+
+void writeJson(ostream& out, const vector<Record>& records)
+{
+   auto number = [&out](const double x) -> ostream& { return isfinite(x) ? out << x : out << "null" ; } ;
+
+   out << setprecision(6) << "[\n" ;
+   for(size_t i=0 ; i < records.size() ; i++)
+   {
+      const auto& r = records[i] ;
+
+      out << "  { \"problem\": \"" << r.problem << "\", \"solver\": \"" << r.solver << "\", \"dt\": " ;
+      number(r.dt)        << ", \"steps\": " << r.steps << ", \"reps\": " << r.reps << ", \"wall_ms\": " ;
+      number(r.ms)        << ", \"ns_per_step\": " ;
+      number(r.nsPerStep) << ", \"rhs_evals\": " << r.rhsEvals << ", \"max_error\": " ;
+      number(r.maxErr)    << ", \"l2_error\": " ;
+      number(r.l2Err)     << ", \"status\": \"" << r.status << "\" }"
+                          << (i+1 < records.size() ? ",\n" : "\n") ;
+   }
+   out << "]\n" ;
+}
+
+
+
+int main(int argc, char* argv[]){
+
+   const string format = argc > 1 ? argv[1] : "csv" ;
+
+   if(format != "csv" && format != "json")
+   {
+      cerr << "usage : " << argv[0] << " [csv|json] [file]" << endl ;
+      return 1 ;
+   }
+
+   ofstream file ;
+   if(argc > 2)
+   {
+      file.open(argv[2]) ;
+      if(!file)
+      {
+         cerr << "Error opening file " << argv[2] << endl ;
+         return 1 ;
+      }
+   }
+   ostream& out = argc > 2 ? file : cout ;
+
+   vector<Record> records ;
+
+   runProblem(records, "problem1",
+              [](double t, double u) { return -10*(t-1)*u; },
+              [](double t, double  ) { return exp(-5*pow((t-1),2) ); },
+              0.0, 2.0, exp(-5.0));
+
+   runProblem(records, "problem2",
+              [](double t, double u) { return -20*u+20*sin(t)+cos(t) ; },
+              [](double t, double  ) { return exp(-20*t)+sin(t) ; },
+              0.0, 2.5, 1.0);
+
+   runProblem(records, "problem3",
+              [](double t, double u) { return t*u ; },
+              [](double t, double  ) { return exp(pow(t,2)/2.0); },
+              -2.0, 2.0, exp(2.0));
+
+   runProblem(records, "problem4",
+              [](double t, double u) { return -2.0*t*u*u; },
+              [](double t, double  ) { return 1.0/(1+pow(t,2)) ; },
+              -5.0, 5.0, 1.0/26.0);
+
+   runProblem(records, "problem5",
+              [](double t, double u) { return (2*t*u*u + 4)/(2*(3-t*t*u)) ; },
+              [](double t, double  ) { return (3+ sqrt(9+12*t*t-4*pow(t,3)))/(t*t) ; },
+              -1.0, -0.1, 8.0);
+
+   if(format == "csv") writeCsv (out, records) ;
+   else                writeJson(out, records) ;
+
+  return 0;
+}
@@ -0,0 +1,83 @@
+# include <iostream>
+# include <iomanip>
+# include <vector>
+# include <chrono>
+# include <cmath>
+# include "../rhsOdeProblem.H"
+# include "../Parallel/BatchExecutor.H"
+
+using namespace std;
+using namespace mg::numeric::ode ;
+
+/*-----------------------------------------------------------------------------
+ *
+ *    Batch of independent solves : problems 1-5 , every solver kind ,
+ *    4 refinements of the step size , run on 1 thread and on all threads ;
+ *    the results must not depend on the number of threads
+ *
+ -----------------------------------------------------------------------------*/
+
+
+struct Problem { rhsFunction<double> f ; double t0 , tf , dt , u0 ; } ;
+
+
+double runBatch(BatchExecutor<double>& batch)
+{
+   auto start = chrono::steady_clock::now();
+   batch.run();
+   auto stop  = chrono::steady_clock::now();
+   return chrono::duration<double>(stop-start).count();
+}
+
+
+int main(){
+
+   const vector<Problem> problems = {
+      { [](double t, double u) { return -10*(t-1)*u; }                  ,  0.0,  2.0, 0.025, exp(-5.0) },
+      { [](double t, double u) { return -20*u+20*sin(t)+cos(t) ; }       ,  0.0,  2.5, 0.005, 1.0       },
+      { [](double t, double u) { return t*u ; }                          , -2.0,  2.0, 0.3  , exp(2.0)  },
+      { [](double t, double u) { return -2.0*t*u*u; }                    , -5.0,  5.0, 0.04 , 1.0/26.0  },
+      { [](double t, double u) { return (2*t*u*u + 4)/(2*(3-t*t*u)) ; }  , -1.0, -0.1, 0.05 , 8.0       }
+   };
+
+   const SolverKind kinds[] = {
+      SolverKind::ForwardEuler , SolverKind::BackwardEuler , SolverKind::Heun , SolverKind::ModifiedEuler ,
+      SolverKind::RungeKutta4 , SolverKind::CrankNicholson , SolverKind::DormandPrince , SolverKind::LeapFrog ,
+      SolverKind::AdamsBashforth2 , SolverKind::AdamsBashforth3 , SolverKind::AdamsBashforth4 , SolverKind::AdamsBashforth5 ,
+      SolverKind::AdamsMoulton2 , SolverKind::AdamsMoulton3 , SolverKind::AdamsMoulton4 , SolverKind::AdamsMoulton5
+   };
+
+   BatchExecutor<double> serial(1) , parallel ;
+
+   for(const auto& p : problems)
+      for(double refine = 1 ; refine <= 1000 ; refine *= 10)
+         for(auto kind : kinds)
+         {
+            rhsOdeProblem<double> problem(p.f, p.t0, p.tf, p.dt/refine, p.u0) ;
+            serial.add(problem, kind) ;
+            parallel.add(problem, kind) ;
+         }
+
+   const double tSerial   = runBatch(serial) ;
+   const double tParallel = runBatch(parallel) ;
+
+   std::size_t failed = 0 , different = 0 ;
+   for(std::size_t id=0 ; id < serial.size() ; id++)
+   {
+      const auto& a = serial.result(id) ;
+      const auto& b = parallel.result(id) ;
+      if( !a.ok() || !b.ok() ) failed++ ;
+      if( a.t != b.t || a.u != b.u ) different++ ;
+   }
+
+   cout << setprecision(4) ;
+   cout << "jobs              : " << serial.size() << endl ;
+   cout << "threads           : " << parallel.threads() << endl ;
+   cout << "1 thread      [s] : " << tSerial << endl ;
+   cout << "all threads   [s] : " << tParallel << "   speedup " << tSerial/tParallel << endl ;
+   cout << "stolen jobs       : " << parallel.steals() << endl ;
+   cout << "failed jobs       : " << failed << endl ;
+   cout << "differing results : " << different << endl ;
+
+  return different != 0 ;
+}
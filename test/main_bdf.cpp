@@ -0,0 +1,189 @@
+# include <iostream>
+# include <iomanip>
+# include <string>
+# include <vector>
+# include <chrono>
+# include <cmath>
+# include "../rhsOdeProblem.H"
+# include "../rhsOdeSystem.H"
+# include "../RungeKutta/DormandPrince/DormandPrinceSolver.H"
+# include "../MultiStep/BDF/BDFSolver.H"
+
+using namespace std;
+using namespace mg::numeric::ode ;
+
+/*-----------------------------------------------------------------------------
+ *
+ *    Variable order BDF on stiff problems
+ *
+ *    1) dy/dt = -1e4 (y - cos t) - sin t : explicit Dormand-Prince is held by
+ *       its stability limit (h ~ 3e-4) long after the transient , BDF is not
+ *    2) Robertson chemical kinetics (3 species , rates 0.04 / 1e4 / 3e7) ,
+ *       dense Jacobian from differences , dual numbers and the user
+ *    3) heat equation u_t = u_xx on N interior nodes , tridiagonal Jacobian :
+ *       banded against dense LU ; explicit RK4 would need h < 2.78 dx^2/4
+ *
+ -----------------------------------------------------------------------------*/
+
+
+template <typename Solver>
+void report(const string name, const Solver& s, const double err, const double ms)
+{
+   cout << setw(22) << name << setw(9) << s.acceptedSteps() << setw(9) << s.rejectedSteps()
+        << setw(10) << s.rhsEvaluations() << setw(8) << s.jacobianEvaluations()
+        << setw(8) << s.factorizations() << setw(13) << err << setw(10) << ms << endl ;
+}
+
+template <typename Fun>
+double elapsed(Fun&& fun)
+{
+   const auto start = chrono::steady_clock::now() ;
+   fun() ;
+   return chrono::duration<double,milli>(chrono::steady_clock::now() - start).count() ;
+}
+
+void header()
+{
+   cout << setw(22) << "solver" << setw(9) << "steps" << setw(9) << "rejected" << setw(10) << "rhs"
+        << setw(8) << "jac" << setw(8) << "LU" << setw(13) << "error" << setw(10) << "ms" << endl ;
+}
+
+
+//- 1) stiff scalar
+//
+void stiffScalar()
+{
+   const double lambda = -1e4 , t0 = 0 , tf = 10 , dt = 1e-4 ;
+   auto exact = [=](double t) { return cos(t) + exp(lambda*t) ; } ;
+
+   cout << endl << "1) dy/dt = -1e4 (y - cos t) - sin t , t in [0,10]" << endl ;
+   header() ;
+
+   auto scalar = makeOdeProblem([=](double t, double u) { return lambda*(u-cos(t)) - sin(t) ; }, t0, tf, dt, 2.0) ;
+   DormandPrinceSolver<double,decltype(scalar)::function_type> dp(scalar) ;
+   dp.setTolerance(1e-6, 1e-9) ;
+
+   double errDp = 0 ;
+   const double msDp = elapsed([&]{ dp.stream([&](double t, double u){ errDp = max(errDp, fabs(u-exact(t))); }); }) ;
+
+   cout << setw(22) << "DormandPrince" << setw(9) << dp.acceptedSteps() << setw(9) << dp.rejectedSteps()
+        << setw(10) << dp.rhsEvaluations() << setw(8) << "-" << setw(8) << "-"
+        << setw(13) << errDp << setw(10) << msDp << endl ;
+
+   auto system = makeOdeSystem([=](double t, const double* u, double* du) { du[0] = lambda*(u[0]-cos(t)) - sin(t) ; },
+                               t0, tf, dt, vector<double>{2.0}) ;
+   BDFSolver<double,decltype(system)::function_type> bdf(system) ;
+   bdf.setTolerance(1e-6, 1e-9) ;
+
+   double errBdf = 0 ;
+   const double msBdf = elapsed([&]{ bdf.stream([&](double t, const double* u, size_t){ errBdf = max(errBdf, fabs(u[0]-exact(t))); }); }) ;
+
+   report("BDF", bdf, errBdf, msBdf) ;
+}
+
+
+//- 2) Robertson
+//
+void robertson()
+{
+   auto numFun  = [](double, const double* y, double* dy)
+   {
+      dy[0] = -0.04*y[0] + 1e4*y[1]*y[2] ;
+      dy[2] =  3e7*y[1]*y[1] ;
+      dy[1] = -dy[0] - dy[2] ;
+   };
+   auto autoFun = [](auto, const auto* y, auto* dy)
+   {
+      dy[0] = -0.04*y[0] + 1e4*y[1]*y[2] ;
+      dy[2] =  3e7*y[1]*y[1] ;
+      dy[1] = -dy[0] - dy[2] ;
+   };
+   auto jacFun  = [](double, const double* y, SystemMatrix<double>& J)
+   {
+      J(0,0) = -0.04 ; J(0,1) =  1e4*y[2]           ; J(0,2) =  1e4*y[1] ;
+      J(2,0) =  0    ; J(2,1) =  6e7*y[1]           ; J(2,2) =  0 ;
+      J(1,0) =  0.04 ; J(1,1) = -1e4*y[2]-6e7*y[1]  ; J(1,2) = -1e4*y[1] ;
+   };
+
+   // reference at t = 40 (Hairer & Wanner)
+   const double ref[3] = { 0.7158270687193941 , 9.185534764557338e-06 , 0.2841637457458413 } ;
+
+   cout << endl << "2) Robertson , t in [0,40] , rtol 1e-8 , atol 1e-12" << endl ;
+   header() ;
+
+   auto run = [&](const string name, auto problem)
+   {
+      BDFSolver<double,typename decltype(problem)::function_type> bdf(problem) ;
+      bdf.setTolerance(1e-8, 1e-12) ;
+
+      vector<double> y(3) ;
+      const double ms = elapsed([&]{ bdf.stream([&](double, const double* u, size_t){ y.assign(u, u+3); }); }) ;
+
+      double err = 0 ;
+      for(int i=0 ; i < 3 ; i++) err = max(err, fabs(y[i]-ref[i])/ref[i]) ;
+      report(name, bdf, err, ms) ;
+   };
+
+   const vector<double> y0 = {1, 0, 0} ;
+
+   rhsOdeSystem<double> pFd(numFun, 0.0, 40.0, 1e-6, y0) ;
+   rhsOdeSystem<double> pUser(numFun, 0.0, 40.0, 1e-6, y0) ;
+   pUser.setJacobian(jacFun) ;
+
+   run("BDF diff" , pFd) ;
+   run("BDF dual" , makeOdeSystem(autoFun, 0.0, 40.0, 1e-6, y0)) ;
+   run("BDF user" , pUser) ;
+}
+
+
+//- 3) heat equation
+//
+void heat(const size_t N)
+{
+   const double dx = 1.0/(N+1) , tf = 0.5 , pi = acos(-1.0) ;
+
+   auto lap = [N,dx](double, const double* u, double* du)
+   {
+      const double c = 1/(dx*dx) ;
+      for(size_t i=0 ; i < N ; i++)
+         du[i] = c*( (i > 0 ? u[i-1] : 0) - 2*u[i] + (i+1 < N ? u[i+1] : 0) ) ;
+   };
+
+   vector<double> u0(N) ;
+   for(size_t i=0 ; i < N ; i++) u0[i] = sin(pi*(i+1)*dx) ;
+
+   cout << endl << "3) heat equation , " << N << " nodes , t in [0,0.5] : explicit RK4 needs > "
+        << size_t(tf*4/(dx*dx)/2.78) << " steps" << endl ;
+   header() ;
+
+   for(bool banded : {true, false})
+   {
+      auto problem = makeOdeSystem(lap, 0.0, tf, 1e-4, u0) ;
+      if(banded) problem.setBandwidth(1,1) ;
+
+      BDFSolver<double,decltype(problem)::function_type> bdf(problem) ;
+      bdf.setTolerance(1e-6, 1e-10) ;
+
+      vector<double> u(N) ;
+      const double ms = elapsed([&]{ bdf.stream([&](double, const double* ui, size_t){ u.assign(ui, ui+N); }); }) ;
+
+      // semi-discrete exact solution
+      const double decay = exp(-4/(dx*dx)*pow(sin(pi*dx/2),2)*tf) ;
+      double err = 0 ;
+      for(size_t i=0 ; i < N ; i++) err = max(err, fabs(u[i] - decay*u0[i])) ;
+
+      report(banded ? "BDF banded" : "BDF dense", bdf, err, ms) ;
+   }
+}
+
+
+int main(){
+
+   cout << setprecision(4) ;
+
+   stiffScalar() ;
+   robertson() ;
+   heat(400) ;
+
+  return 0;
+}
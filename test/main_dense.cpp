@@ -0,0 +1,106 @@
+# include <iostream>
+# include <iomanip>
+# include <string>
+# include <vector>
+# include <cmath>
+# include <algorithm>
+# include "../rhsOdeProblem.H"
+# include "../SolverFactory.H"
+# include "../RungeKutta/DormandPrince/DormandPrinceSolver.H"
+
+using namespace std;
+using namespace mg::numeric::ode ;
+
+/*-----------------------------------------------------------------------------
+ *
+ *    Dense output on problem 1 : y' = -10(t-1) y , y(0) = e^-5 , t in [0,2]
+ *    exact y = exp(-5(t-1)^2) , steps dt = 0.05 , output grid dt/7
+ *
+ *    for every solver :
+ *       - max error at the steps (stream) and on the grid (streamAt) , the
+ *         interpolant adds little to the error of the method ; Dormand-Prince
+ *         takes long steps where the cubic Hermite is less accurate
+ *       - extra rhs evaluations of streamAt over stream
+ *       - denseSolve() on the grid gives the values of streamAt
+ *
+ -----------------------------------------------------------------------------*/
+
+
+size_t nEval = 0 ;
+
+auto numFun  = [](double t, double u) { ++nEval ; return -10*(t-1)*u ; } ;
+auto exacFun = [](double t) { return exp(-5*pow(t-1,2)) ; } ;
+
+using F = decltype(numFun) ;
+
+
+vector<double> makeGrid(const double dt)
+{
+   vector<double> grid ;
+   for(int i=0 ; i*dt/7 <= 2.0 ; i++) grid.push_back(i*dt/7) ;
+   return grid ;
+}
+
+
+template <typename Solver>
+void run(const string name, Solver& solver, const double dt)
+{
+   solver.setProgress(nullptr) ;
+
+   double nodeErr = 0 ;
+   nEval = 0 ;
+   solver.stream([&](double t, double u){ nodeErr = max(nodeErr, fabs(u - exacFun(t))) ; }) ;
+   const size_t evals = nEval ;
+
+   const auto grid = makeGrid(dt) ;
+   size_t count = 0 ;
+   double err   = 0 ;
+
+   nEval = 0 ;
+   solver.streamAt(grid, [&](double t, double u){ err = max(err, fabs(u - exacFun(t))) ; ++count ; }) ;
+   const size_t extra = nEval - evals ;
+
+   // stored solution at the same grid
+   const auto sol = solver.denseSolve() ;
+   vector<double> streamed ;
+   solver.streamAt(grid, [&](double, double u){ streamed.push_back(u) ; }) ;
+   const bool same = sol(vector<double>(grid.begin(), grid.begin()+streamed.size())) == streamed ;
+
+   cout << setw(16) << name << setw(12) << nodeErr << setw(12) << err << setw(11) << err/nodeErr
+        << setw(7) << extra << setw(6) << count << "/" << grid.size() << (same ? "" : "   denseSolve differs") << endl ;
+}
+
+
+int main(){
+
+   cout << setprecision(3) ;
+
+   const double dt = 0.05 ;
+
+   auto p = makeOdeProblem(numFun, 0.0, 2.0, dt, exp(-5.0)) ;
+
+   cout << setw(16) << "solver" << setw(12) << "node err" << setw(12) << "grid err" << setw(11) << "grid/node"
+        << setw(7) << "+rhs" << setw(10) << "points" << endl ;
+
+   for(const auto kind : { SolverKind::ForwardEuler   , SolverKind::BackwardEuler  ,
+                           SolverKind::Heun           , SolverKind::ModifiedEuler  ,
+                           SolverKind::RungeKutta4    , SolverKind::CrankNicholson ,
+                           SolverKind::LeapFrog       ,
+                           SolverKind::AdamsBashforth2, SolverKind::AdamsBashforth3,
+                           SolverKind::AdamsBashforth4, SolverKind::AdamsBashforth5,
+                           SolverKind::AdamsMoulton2  , SolverKind::AdamsMoulton3  ,
+                           SolverKind::AdamsMoulton4  , SolverKind::AdamsMoulton5  })
+   {
+      auto solver = makeSolver(kind, p) ;
+      run(toString(kind), *solver, dt) ;
+   }
+
+   // adaptive steps : the grid does not follow them
+   DormandPrinceSolver<double,F> dp(p) ;
+   dp.setTolerance(1e-6, 1e-8) ;
+   run("DormandPrince", dp, dt) ;
+
+   cout << endl << "u(1) = " << setprecision(12) << dp.denseSolve()(1.0) << "  exact 1" << endl ;
+
+  return 0;
+}
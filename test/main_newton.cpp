@@ -0,0 +1,79 @@
+# include <iostream>
+# include <iomanip>
+# include <string>
+# include <cmath>
+# include "../rhsOdeProblem.H"
+# include "../Euler/BackwardEulerSolver.H"
+# include "../RungeKutta/CrankNicholson/CrankNicholsonSolver.H"
+# include "../MultiStep/AdamsMethods/AdamsMoulton/AdamsMoulton2ndSolver.H"
+
+using namespace std;
+using namespace mg::numeric::ode ;
+
+/*-----------------------------------------------------------------------------
+ *
+ *    Implicit solvers on a stiff problem , dy/dt = -1000 (y - cos t) - sin t ,
+ *    y = cos t + (y0-1) exp(-1000 t) , with dt*lambda = 10 : the corrector
+ *    needs Newton , a fixed-point iteration diverges
+ *
+ *    df/du from a central difference , from dual numbers (generic lambda)
+ *    and from a user Jacobian
+ *
+ *    (Crank-Nicolson is not L-stable : the initial transient decays slowly ;
+ *    Adams-Moulton 2 starts with an implicit step , an explicit start-up
+ *    is unstable at dt*lambda = 10 ; Adams-Moulton 3-5 are not A-stable ,
+ *    dt*lambda = 10 is outside their stability interval whatever the start)
+ *
+ -----------------------------------------------------------------------------*/
+
+
+auto numFun  = [](double t, double u) { return -1000*(u-cos(t)) - sin(t) ; } ;
+auto autoFun = [](auto t, auto u)     { using std::sin ; using std::cos ; return -1000*(u-cos(t)) - sin(t) ; } ;
+auto jacFun  = [](double  , double  ) { return -1000.0 ; } ;
+auto exacFun = [](double t)           { return cos(t) + exp(-1000*t) ; } ;
+
+
+template <typename Solver>
+void run(const string name, const string jacobian, Solver&& solver)
+{
+   double maxErr = 0 ;
+   solver.stream([&](double t, double u) { if(t > 0.05) maxErr = max(maxErr, fabs(u - exacFun(t))); });
+
+   auto& newton = solver.nonlinearSolver() ;
+
+   cout << setw(16) << name << setw(10) << jacobian
+        << setw(12) << newton.iterations() << setw(10) << newton.jacobianEvaluations()
+        << setw(10) << newton.rejectedSteps() << setw(14) << maxErr << endl ;
+}
+
+
+int main(){
+
+   const double t0 = 0.0 , tf = 2.0 , dt = 0.01 , u0 = 2.0 ;
+
+   rhsOdeProblem<double> pFd(numFun, t0, tf, dt, u0) ;
+   auto pAd = makeOdeProblem(autoFun, t0, tf, dt, u0) ;
+   rhsOdeProblem<double> pUser(numFun, t0, tf, dt, u0) ;
+   pUser.setJacobian(jacFun) ;
+
+   cout << "df/du at t=1 , u=0.5 :  difference " << setprecision(16) << pFd.dfdu(1.0,0.5)
+        << "   dual " << pAd.dfdu(1.0,0.5) << "   user " << pUser.dfdu(1.0,0.5) << endl << endl ;
+
+   cout << setprecision(4) ;
+   cout << setw(16) << "solver" << setw(10) << "df/du" << setw(12) << "iterations"
+        << setw(10) << "jacobian" << setw(10) << "rejected" << setw(14) << "max error" << endl ;
+
+   run("BackwardEuler" , "diff", BackwardEulerSolver<double>(pFd));
+   run("BackwardEuler" , "dual", BackwardEulerSolver<double,decltype(autoFun)>(pAd));
+   run("BackwardEuler" , "user", BackwardEulerSolver<double>(pUser));
+
+   run("CrankNicholson", "diff", CrankNicholsonSolver<double>(pFd));
+   run("CrankNicholson", "dual", CrankNicholsonSolver<double,decltype(autoFun)>(pAd));
+   run("CrankNicholson", "user", CrankNicholsonSolver<double>(pUser));
+
+   run("AdamsMoulton2" , "diff", AdamsMoulton2ndSolver<double>(pFd));
+   run("AdamsMoulton2" , "dual", AdamsMoulton2ndSolver<double,decltype(autoFun)>(pAd));
+   run("AdamsMoulton2" , "user", AdamsMoulton2ndSolver<double>(pUser));
+
+  return 0;
+}
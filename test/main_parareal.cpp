@@ -0,0 +1,107 @@
+# include <iostream>
+# include <iomanip>
+# include <cmath>
+# include <stdexcept>
+# include "../rhsOdeProblem.H"
+# include "../Parallel/Parareal.H"
+
+using namespace std;
+using namespace mg::numeric::ode ;
+
+/*-----------------------------------------------------------------------------
+ *
+ *    Parareal on a long trajectory of problem 2
+ *
+ *       y' = -20 y + 20 sin t + cos t , y(0) = 1 , t in [0,20] , dt = 0.01
+ *
+ *    1) coarse ForwardEuler (dt = 0.05 , stable) , fine RungeKutta4 and
+ *       AdamsBashforth4 , tol 1e-8 : the error of the fine solvers (4e-8 and
+ *       1e-10 at tf) dominates , Parareal converges to the fine solution of
+ *       each method ; iterations and speedup versus the serial fine solve
+ *       for 4 ... 32 slices on all the hardware threads (the speedup is
+ *       bounded by threads / iterations , below 1 on a single core)
+ *
+ *    2) y' = -y on [0,0.8] , dt = 0.1 : 4 slices of 2 steps are shorter
+ *       than the 3 start-up steps of AdamsBashforth4 and are rejected ,
+ *       2 slices of 4 steps agree with the serial solve up to the restart
+ *       of the start-up on the second slice
+ *
+ *    3) maxIterations 2 of 16 slices at tol 1e-14 : not converged
+ *
+ -----------------------------------------------------------------------------*/
+
+
+auto numFun = [](double t, double u) { return -20*u+20*sin(t)+cos(t) ; } ;
+auto decFun = [](double  , double u) { return -u ; } ;
+
+using F = decltype(numFun) ;
+using D = decltype(decFun) ;
+
+
+int main(){
+
+   cout << setprecision(4) ;
+
+   const double t0 = 0 , tf = 20 ;
+
+   auto p = makeOdeProblem(numFun, t0, tf, 0.01, 1.0) ;
+
+   cout << "1) problem 2 , t in [0,20] , dt = 0.01 , tol 1e-8" << endl << endl ;
+
+   for(const auto fine : { SolverKind::RungeKutta4 , SolverKind::AdamsBashforth4 })
+   {
+      cout << "fine " << toString(fine) << endl ;
+
+      for(const size_t slices : { 4, 8, 16, 32 })
+      {
+         Parareal<double,F> pr(p, slices, fine, SolverKind::ForwardEuler) ;
+         pr.setCoarseSteps( static_cast<size_t>((tf-t0)/slices/0.05) ) ;
+         pr.setTolerance(1e-8) ;
+         pr.compare() ;
+
+         cout << pr.stats()
+              << "   |u(tf) - exact| " << fabs(pr.values().back() - (exp(-20*pr.times().back()) + sin(pr.times().back())))
+              << endl ;
+      }
+      cout << endl ;
+   }
+
+
+   cout << "2) y' = -y , t in [0,0.8] , dt = 0.1 , fine AdamsBashforth4" << endl << endl ;
+
+   auto q = makeOdeProblem(decFun, 0.0, 0.8, 0.1, 1.0) ;
+
+   try
+   {
+      Parareal<double,D> pr(q, 4, SolverKind::AdamsBashforth4) ;
+      cout << "   4 slices : not rejected" << endl ;
+   }
+   catch(const std::invalid_argument& e)
+   {
+      cout << "   4 slices : " << e.what() << endl ;
+   }
+
+   {
+      Parareal<double,D> pr(q, 2, SolverKind::AdamsBashforth4) ;
+      pr.setCoarseSteps(4) ;
+      pr.compare() ;
+
+      cout << "   2 slices : u(tf) " << pr.values().back() << " , exact " << exp(-0.8)
+           << " , |u(tf) - serial| " << pr.stats().difference << endl << endl ;
+   }
+
+
+   cout << "3) problem 2 , 16 slices , tol 1e-14 , maxIterations 2" << endl << endl ;
+
+   {
+      Parareal<double,F> pr(p, 16, SolverKind::RungeKutta4, SolverKind::ForwardEuler) ;
+      pr.setCoarseSteps( static_cast<size_t>((tf-t0)/16/0.05) ) ;
+      pr.setTolerance(1e-14) ;
+      pr.setMaxIterations(2) ;
+      pr.compare() ;
+
+      cout << pr.stats() << "   converged() " << boolalpha << pr.converged() << endl ;
+   }
+
+  return 0;
+}
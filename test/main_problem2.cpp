@@ -62,6 +62,26 @@ int main(){
   
    LeapFrogSolver<double> leapFrog(p1);
    leapFrog.solve("LeapFrog_2.out");
+
+   AdamsBashforth4thSolver<double> ab4(p1);
+   ab4.solve("AdamBashforth4_2.out");
+   cout << "   rhs evaluations : " << ab4.rhsEvaluations() << endl;
+
+   AdamsMoulton4thSolver<double> am4(p1);
+   am4.solve("AdamMoulton4_2.out");
+   cout << "   rhs evaluations : " << am4.rhsEvaluations() << endl;
+
+   // streaming mode : 500k steps, nothing is stored, only the max error is tracked
+   rhsOdeProblem<double> p2(numFun, t0, tf, dt/1000, u0);
+   
+   RungeKutta4Solver<double> rk4s(p2);
+   double maxErr = 0.0;
+   rk4s.stream([&](double t, double u) { maxErr = max(maxErr, fabs(u - exacFun(t,u))); });
+   cout << "RK4 streaming (dt/1000) max error : " << maxErr << endl;
+
+   // same fine run written as a packed binary trajectory, one step out of 100 
+   rk4s.setOutput(OutputFormat::binary, 100);
+   rk4s.solve("RK4_fine_2.bin");
   
   return 0;    
 }
@@ -9,6 +9,8 @@
 # include "../RungeKutta/Heun/HeunSolver.H"
 # include "../RungeKutta/RungeKutta4th/RungeKutta4Solver.H"
 # include "../MultiStep/LeapFrogSolver.H"
+# include "../MultiStep/AdamsMethods/AdamsBashforth/AdamsBashforth4thSolver.H"
+# include "../MultiStep/AdamsMethods/AdamsMoulton/AdamsMoulton4thSolver.H"
 
 using namespace std;
 using namespace mg::numeric::ode ;
@@ -47,6 +49,14 @@ int main(){
 
    LeapFrogSolver<double> leapFrog(p1);
    leapFrog.solve("LeapFrog_3.out");
+
+   AdamsBashforth4thSolver<double> ab4(p1);
+   ab4.solve("AdamBashforth4_3.out");
+   cout << "   rhs evaluations : " << ab4.rhsEvaluations() << endl;
+
+   AdamsMoulton4thSolver<double> am4(p1);
+   am4.solve("AdamMoulton4_3.out");
+   cout << "   rhs evaluations : " << am4.rhsEvaluations() << endl;
    
   return 0;    
 }
@@ -60,27 +60,35 @@ int main(){
    
    AdamsBashforth2ndSolver<double> ab2(p1);
    ab2.solve("AdamBashforth2_5.out");
+   cout << "   rhs evaluations : " << ab2.rhsEvaluations() << endl;
    
    AdamsBashforth3thSolver<double> ab3(p1);
    ab3.solve("AdamBashforth3_5.out");
+   cout << "   rhs evaluations : " << ab3.rhsEvaluations() << endl;
 
    AdamsBashforth4thSolver<double> ab4(p1);
    ab4.solve("AdamBashforth4_5.out");
+   cout << "   rhs evaluations : " << ab4.rhsEvaluations() << endl;
 
    AdamsBashforth5thSolver<double> ab5(p1);
    ab5.solve("AdamBashforth5_5.out");
+   cout << "   rhs evaluations : " << ab5.rhsEvaluations() << endl;
  
    AdamsMoulton2ndSolver<double> am2(p1);
    am2.solve("AdamMoulton2_5.out");
+   cout << "   rhs evaluations : " << am2.rhsEvaluations() << endl;
    
    AdamsMoulton3thSolver<double> am3(p1);
    am3.solve("AdamMoulton3_5.out");
+   cout << "   rhs evaluations : " << am3.rhsEvaluations() << endl;
 
    AdamsMoulton4thSolver<double> am4(p1);
    am4.solve("AdamMoulton4_5.out");
+   cout << "   rhs evaluations : " << am4.rhsEvaluations() << endl;
 
    AdamsMoulton5thSolver<double> am5(p1);
    am5.solve("AdamMoulton5_5.out");
+   cout << "   rhs evaluations : " << am5.rhsEvaluations() << endl;
 
 
 
@@ -0,0 +1,79 @@
+# define MG_ODE_STATS  1
+# define MG_ODE_TIMERS 1
+
+# include <iostream>
+# include <iomanip>
+# include <string>
+# include <cmath>
+# include "../rhsOdeProblem.H"
+# include "../Euler/ForwardEulerSolver.H"
+# include "../Euler/BackwardEulerSolver.H"
+# include "../RungeKutta/RungeKutta4th/RungeKutta4Solver.H"
+# include "../RungeKutta/CrankNicholson/CrankNicholsonSolver.H"
+# include "../RungeKutta/DormandPrince/DormandPrinceSolver.H"
+# include "../MultiStep/AdamsMethods/AdamsBashforth/AdamsBashforth4thSolver.H"
+# include "../MultiStep/AdamsMethods/AdamsMoulton/AdamsMoulton4thSolver.H"
+
+using namespace std;
+using namespace mg::numeric::ode ;
+
+/*-----------------------------------------------------------------------------
+ *
+ *    Solver instrumentation (built with MG_ODE_STATS and MG_ODE_TIMERS) :
+ *    counters , iterations per step and timers on the stiff problem 2
+ *
+ *       y' = -20 y + 20 sin t + cos t , y(0) = 1 , t in [0,2.5]
+ *
+ *    the rhs counts of stats() must agree with the solvers' own counters
+ *    and with the calls of the rhs , df/du included (central difference
+ *    in the implicit solvers)
+ *
+ -----------------------------------------------------------------------------*/
+
+
+size_t nCalls = 0 ;
+
+auto numFun = [](double t, double u) { ++nCalls ; return -20*u+20*sin(t)+cos(t) ; } ;
+
+using F = decltype(numFun) ;
+
+
+template <typename Solver>
+void run(const string name, Solver&& solver)
+{
+   solver.setProgress(nullptr) ;
+
+   double uf = 0 ;
+   nCalls = 0 ;
+   solver.stream([&](double, double u){ uf = u ; }) ;
+
+   cout << name << "   u(tf) error " << fabs(uf - (exp(-20*2.5)+sin(2.5))) << " , rhs calls " << nCalls << endl ;
+   cout << solver.stats() << endl ;
+}
+
+
+int main(){
+
+   cout << setprecision(4) ;
+
+   auto p = makeOdeProblem(numFun, 0.0, 2.5, 0.05, 1.0) ;
+
+   run("ForwardEuler"   , ForwardEulerSolver<double,F>(p)) ;
+   run("RungeKutta4"    , RungeKutta4Solver<double,F>(p)) ;
+   run("BackwardEuler"  , BackwardEulerSolver<double,F>(p)) ;
+   run("CrankNicholson" , CrankNicholsonSolver<double,F>(p)) ;
+   run("AdamsBashforth4", AdamsBashforth4thSolver<double,F>(p)) ;
+
+   AdamsMoulton4thSolver<double,F> am4(p) ;
+   run("AdamsMoulton4"  , am4) ;
+   cout << "   AdamsMoulton4 rhsEvaluations() " << am4.rhsEvaluations()
+        << " , stats " << am4.stats().rhsEvaluations << endl << endl ;
+
+   DormandPrinceSolver<double,F> dp(p) ;
+   dp.setTolerance(1e-8, 1e-10) ;
+   run("DormandPrince"  , dp) ;
+   cout << "   DormandPrince accepted/rejected " << dp.acceptedSteps() << "/" << dp.rejectedSteps()
+        << " , rhsEvaluations() " << dp.rhsEvaluations() << endl ;
+
+  return 0;
+}
@@ -0,0 +1,169 @@
+# include <iostream>
+# include <iomanip>
+# include <string>
+# include <vector>
+# include <chrono>
+# include <cmath>
+# include <fstream>
+# include <iterator>
+# include "../rhsOdeProblem.H"
+# include "../rhsOdeSystem.H"
+# include "../RungeKutta/RungeKutta4th/RungeKutta4Solver.H"
+# include "../MultiStep/AdamsMethods/AdamsMoulton/AdamsMoulton4thSolver.H"
+# include "../Euler/ForwardEulerSystemSolver.H"
+# include "../Euler/BackwardEulerSystemSolver.H"
+# include "../RungeKutta/Heun/HeunSystemSolver.H"
+# include "../RungeKutta/ModifiedEuler/ModifiedEulerSystemSolver.H"
+# include "../RungeKutta/RungeKutta4th/RungeKutta4SystemSolver.H"
+# include "../RungeKutta/CrankNicholson/CrankNicholsonSystemSolver.H"
+# include "../MultiStep/LeapFrogSystemSolver.H"
+# include "../MultiStep/AdamsMethods/AdamsBashforth/AdamsBashforthSystemSolver.H"
+# include "../MultiStep/AdamsMethods/AdamsMoulton/AdamsMoultonSystemSolver.H"
+# include "../MultiStep/BDF/BDFSolver.H"
+
+using namespace std;
+using namespace mg::numeric::ode ;
+
+/*-----------------------------------------------------------------------------
+ *
+ *    Systems of ODEs : every solver family on
+ *
+ *    1) N = 1000 uncoupled oscillators  x_i'' = -w_i^2 x_i  (2N state ,
+ *       one contiguous block) , x_i(t) = cos(w_i t) ; error at t = 2
+ *    2) a 1-component system against the scalar solver of the same scheme :
+ *       the trajectories must agree to round-off
+ *    3) output of solve(filename) through the sinks of the scalar solvers :
+ *       the 1-component system writes the file of the scalar solver , the
+ *       oscillators a binary file one step out of 100 (setOutput)
+ *
+ -----------------------------------------------------------------------------*/
+
+
+const size_t Nosc = 1000 ;
+
+auto oscillators = [](double, const double* u, double* du)
+{
+   // u = ( x_0 , v_0 , x_1 , v_1 ... ) , w_i = 1 + i/N
+   for(size_t i=0 ; i < Nosc ; i++)
+   {
+      const double w = 1 + double(i)/Nosc ;
+      du[2*i]   =  u[2*i+1] ;
+      du[2*i+1] = -w*w*u[2*i] ;
+   }
+};
+
+using system_type = decltype(makeOdeSystem(oscillators, 0.0, 2.0, 1e-3, vector<double>{})) ;
+
+
+template <typename Solver>
+void run(const string name, Solver&& solver)
+{
+   const double tf = solver.tf() ;
+   double err = 0 ;
+
+   const auto start = chrono::steady_clock::now() ;
+   solver.solve() ;
+   const double ms = chrono::duration<double,milli>(chrono::steady_clock::now() - start).count() ;
+
+   const double* u = solver.state(solver.times().size()-1) ;
+   for(size_t i=0 ; i < Nosc ; i++) err = max(err, fabs(u[2*i] - cos((1 + double(i)/Nosc)*tf))) ;
+
+   cout << setw(18) << name << setw(10) << solver.times().size()-1 << setw(12) << solver.rhsEvaluations()
+        << setw(14) << err << setw(10) << ms << endl ;
+}
+
+
+int main(){
+
+   vector<double> u0(2*Nosc, 0.0) ;
+   for(size_t i=0 ; i < Nosc ; i++) u0[2*i] = 1 ;
+
+   auto sys = makeOdeSystem(oscillators, 0.0, 2.0, 1e-3, u0) ;
+   sys.setBandwidth(1, 1) ;   // x_i couples to v_i only : tridiagonal Jacobian
+
+   using F = system_type::function_type ;
+
+   cout << setprecision(4) ;
+   cout << "1) " << Nosc << " oscillators , dt = 1e-3 , t in [0,2]" << endl ;
+   cout << setw(18) << "solver" << setw(10) << "steps" << setw(12) << "rhs" << setw(14) << "max error" << setw(10) << "ms" << endl ;
+
+   run("ForwardEuler"   , ForwardEulerSystemSolver<double,F>(sys)) ;
+   run("BackwardEuler"  , BackwardEulerSystemSolver<double,F>(sys)) ;
+   run("Heun"           , HeunSystemSolver<double,F>(sys)) ;
+   run("ModifiedEuler"  , ModifiedEulerSystemSolver<double,F>(sys)) ;
+   run("RungeKutta4"    , RungeKutta4SystemSolver<double,F>(sys)) ;
+   run("CrankNicholson" , CrankNicholsonSystemSolver<double,F>(sys)) ;
+   run("LeapFrog"       , LeapFrogSystemSolver<double,F>(sys)) ;
+   run("AdamsBashforth2", AdamsBashforthSystemSolver<2,double,F>(sys)) ;
+   run("AdamsBashforth5", AdamsBashforthSystemSolver<5,double,F>(sys)) ;
+   run("AdamsMoulton2"  , AdamsMoultonSystemSolver<2,double,F>(sys)) ;
+   run("AdamsMoulton5"  , AdamsMoultonSystemSolver<5,double,F>(sys)) ;
+
+   BDFSolver<double,F> bdf(sys) ;
+   bdf.setTolerance(1e-8, 1e-10) ;
+   run("BDF"            , bdf) ;
+
+
+   //- 2) one component : system solver == scalar solver
+   //
+   auto fs = [](double t, double u) { return -10*(t-1)*u ; } ;
+   auto fv = [](double t, const double* u, double* du) { du[0] = -10*(t-1)*u[0] ; } ;
+
+   auto scalar = makeOdeProblem(fs, 0.0, 2.0, 1e-3, exp(-5.0)) ;
+   auto single = makeOdeSystem (fv, 0.0, 2.0, 1e-3, vector<double>{exp(-5.0)}) ;
+
+   auto compare = [](const string name, auto&& scalarSolver, auto&& systemSolver)
+   {
+      vector<double> us ;
+      scalarSolver.setProgress(nullptr) ;
+      scalarSolver.stream([&](double, double u){ us.push_back(u); }) ;
+      systemSolver.solve() ;
+
+      double du = 0 ;
+      for(size_t n=0 ; n < us.size() ; n++) du = max(du, fabs(us[n] - systemSolver.state(n)[0])) ;
+      cout << setw(18) << name << "  steps " << us.size()-1 << " / " << systemSolver.times().size()-1
+           << "   max |u_scalar - u_system| = " << du << endl ;
+   };
+
+   cout << endl << "2) scalar against 1-component system" << endl ;
+   compare("RungeKutta4" , RungeKutta4Solver<double,decltype(fs)>(scalar), RungeKutta4SystemSolver<double,decltype(fv)>(single)) ;
+   compare("AdamsMoulton4", AdamsMoulton4thSolver<double,decltype(fs)>(scalar), AdamsMoultonSystemSolver<4,double,decltype(fv)>(single)) ;
+
+
+   //- 3) solve(filename)
+   //
+   cout << endl << "3) output" << endl ;
+
+   auto slurp = [](const string& name)
+   {
+      ifstream in(name, ios::binary) ;
+      return string(istreambuf_iterator<char>(in), istreambuf_iterator<char>()) ;
+   };
+
+   RungeKutta4Solver<double,decltype(fs)> rk4(scalar) ;
+   RungeKutta4SystemSolver<double,decltype(fv)> rk4s(single) ;
+   rk4.setProgress(nullptr) ;
+   rk4s.setProgress(nullptr) ;
+   rk4.solve("RK4_scalar.out") ;
+   rk4s.solve("RK4_system.out") ;
+   cout << "   text , 1-component system file == scalar file : " << boolalpha
+        << (slurp("RK4_scalar.out") == slurp("RK4_system.out")) << endl ;
+
+   RungeKutta4SystemSolver<double,F> rk4o(sys) ;
+   rk4o.setProgress(nullptr) ;
+   rk4o.setOutput(OutputFormat::binary, 100) ;
+   rk4o.solve("RK4_oscillators.bin") ;
+
+   const string bin = slurp("RK4_oscillators.bin") ;
+   TrajectoryHeader h ;
+   bin.copy(reinterpret_cast<char*>(&h), sizeof h) ;
+
+   // last row : t , u_0 ... u_width-1
+   const double* last = reinterpret_cast<const double*>(bin.data() + h.dataOffset) + (h.count-1)*(h.width+1) ;
+   const double* uN   = rk4o.state(rk4o.times().size()-1) ;
+
+   cout << "   binary , every 100 : rows " << h.count << " , width " << h.width
+        << " , last row t = " << last[0] << " , == u(tf) : " << equal(uN, uN + h.width, last + 1) << endl ;
+
+  return 0;
+}
@@ -0,0 +1,89 @@
+# include <iostream>
+# include <iomanip>
+# include <string>
+# include <vector>
+# include <cmath>
+# include "../rhsOdeProblem.H"
+# include "../rhsOdeSystem.H"
+# include "../RungeKutta/ExplicitRungeKuttaSolver.H"
+# include "../RungeKutta/ExplicitRungeKuttaSystemSolver.H"
+
+using namespace std;
+using namespace mg::numeric::ode ;
+
+/*-----------------------------------------------------------------------------
+ *
+ *    Explicit Runge-Kutta schemes from their Butcher tableau
+ *
+ *    1) y' = -10(t-1) y , y(0) = e^-5 , y = exp(-5(t-1)^2) : error at t = 1.25
+ *       as dt is halved , the ratio of the errors -> 2^order
+ *    2) the same schemes on a 2-component system (y , y') of y'' = -y ,
+ *       rhs evaluations per step = stages (stages-1 with FSAL)
+ *
+ -----------------------------------------------------------------------------*/
+
+
+auto fs = [](double t, double u) { return -10*(t-1)*u ; } ;
+auto fv = [](double, const double* u, double* du) { du[0] = u[1] ; du[1] = -u[0] ; } ;
+
+using FS = decltype(fs) ;
+using FV = decltype(fv) ;
+
+
+template <typename Tableau>
+void order()
+{
+   cout << setw(34) << Tableau::name << "  order " << Tableau::order << "   error ratios :" ;
+
+   double errPrev = 0 ;
+   for(double dt = 1./32 ; dt > 1./512 ; dt /= 2)
+   {
+      auto problem = makeOdeProblem(fs, 0.0, 1.25, dt, exp(-5.0)) ;
+      ExplicitRungeKuttaSolver<Tableau,double,FS> solver(problem) ;
+
+      double uf = 0 ;
+      solver.stream([&](double, double u){ uf = u ; }) ;
+
+      const double err = fabs(uf - exp(-5*0.0625)) ;
+      if(errPrev > 0) cout << setw(8) << errPrev/err ;
+      errPrev = err ;
+   }
+   cout << endl ;
+}
+
+
+template <typename Tableau>
+void system()
+{
+   auto sys = makeOdeSystem(fv, 0.0, 2.0, 1e-2, vector<double>{1.0, 0.0}) ;
+   ExplicitRungeKuttaSystemSolver<Tableau,double,FV> solver(sys) ;
+   solver.solve() ;
+
+   const double* u = solver.state(solver.times().size()-1) ;
+   cout << setw(34) << Tableau::name << "   rhs/step " << double(solver.rhsEvaluations())/(solver.times().size()-1)
+        << "   |x - cos 2| = " << fabs(u[0] - cos(2.0)) << endl ;
+}
+
+
+int main(){
+
+   cout << setprecision(4) ;
+
+   cout << "1) scalar , dt = 1/32 ... 1/256" << endl ;
+   order<HeunTableau>() ;
+   order<ModifiedEulerTableau>() ;
+   order<RungeKutta4Tableau>() ;
+   order<RungeKutta38Tableau>() ;
+   order<Butcher5Tableau>() ;
+   order<DormandPrinceTableau>() ;
+
+   cout << endl << "2) system y'' = -y , dt = 1e-2" << endl ;
+   system<HeunTableau>() ;
+   system<ModifiedEulerTableau>() ;
+   system<RungeKutta4Tableau>() ;
+   system<RungeKutta38Tableau>() ;
+   system<Butcher5Tableau>() ;
+   system<DormandPrinceTableau>() ;
+
+  return 0;
+}